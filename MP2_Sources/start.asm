@@ -42,8 +42,12 @@ mboot:
 ; This is an endless loop here. Make a note of this: Later on, we
 ; will insert an 'extern _main', followed by 'call _main', right
 ; before the 'jmp $'.
+; The boot loader leaves its magic number in eax and the address of the
+; Multiboot information structure in ebx; main gets both as arguments.
 stublet:
     extern _main
+    push ebx
+    push eax
     call _main
     jmp $
 